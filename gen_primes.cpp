@@ -0,0 +1,85 @@
+// Writes primes.hpp, the prime and prime-power tables main.cpp reads instead
+// of computing them in every translation unit:
+//
+//     g++ -std=c++20 -o gen_primes gen_primes.cpp && ./gen_primes 64 > primes.hpp
+//
+// For each prime p_i the header lists p_i^1, p_i^2, ... up to the largest
+// power that fits in size_t; prime_power_offsets[i] is where p_i's run starts
+// in prime_powers, and prime_power_offsets[i + 1] where it ends.
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+
+#include <iostream>
+#include <limits>
+#include <vector>
+
+int main(int argc, char** argv) {
+    size_t count = 64;
+    if (argc > 1) {
+        char* end = nullptr;
+        errno = 0;
+        unsigned long long const parsed = std::strtoull(argv[1], &end, 10);
+        if (argv[1][0] == '\0' || argv[1][0] == '-' || *end != '\0' || errno != 0
+            || parsed < 1 || parsed > std::numeric_limits<size_t>::max()) {
+            std::cerr << "usage: " << argv[0] << " [count >= 1]\n";
+            return 1;
+        }
+        count = parsed;
+    }
+
+    std::vector<size_t> primes;
+    for (size_t p = 2; primes.size() < count; ++p) {
+        bool prime = true;
+        for (size_t d : primes) {
+            if (d * d > p) {
+                break;
+            }
+            if (p % d == 0) {
+                prime = false;
+                break;
+            }
+        }
+        if (prime) {
+            primes.push_back(p);
+        }
+    }
+
+    std::vector<size_t> offsets{0};
+    std::vector<size_t> powers;
+    for (size_t p : primes) {
+        for (size_t x = p; ; x *= p) {
+            powers.push_back(x);
+            if (x > std::numeric_limits<size_t>::max() / p) {
+                break;
+            }
+        }
+        offsets.push_back(powers.size());
+    }
+
+    auto const emit = [](char const* name, std::vector<size_t> const& values, size_t per_line) {
+        std::cout << "inline constexpr std::array<size_t, " << values.size() << "> " << name << " = {";
+        for (size_t i = 0; i < values.size(); ++i) {
+            std::cout << (i % per_line == 0 ? "\n    " : " ") << values[i] << "u,";
+        }
+        std::cout << "\n};\n";
+    };
+
+    std::cout << "// Generated by gen_primes.cpp; do not edit.\n"
+              << "#pragma once\n"
+              << "\n"
+              << "#include <cstddef>\n"
+              << "\n"
+              << "#include <array>\n"
+              << "#include <limits>\n"
+              << "\n"
+              << "static_assert(std::numeric_limits<size_t>::digits == "
+              << std::numeric_limits<size_t>::digits << ");\n"
+              << "\n";
+    emit("primes", primes, 16);
+    std::cout << "\n";
+    emit("prime_power_offsets", offsets, 16);
+    std::cout << "\n";
+    emit("prime_powers", powers, 4);
+}
@@ -1,7 +1,17 @@
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "primes.hpp"
 
 template <size_t N>
 using chr_arr = std::array<char, N>;
@@ -82,6 +92,26 @@ void constexpr_for(F&& f) {
     }
 }
 
+// Same order as constexpr_for<Start, End, 1>, but split into blocks of Block
+// iterations so the recursion nests about (End - Start) / Block + Block deep
+// instead of End - Start: long operands stay within the compiler's limits.
+template <auto Start, auto End, auto Block, class F>
+requires (Block > 0)
+constexpr
+void constexpr_for_blocked(F&& f) {
+    if constexpr (End <= Start + Block) {
+        constexpr_for<Start, End, 1>(f);
+    } else {
+        constexpr_for<Start, End, Block>([&f](auto b) {
+            constexpr auto first = decltype(b)::value;
+            constexpr auto last = (first + Block < End) ? first + Block : End;
+            constexpr_for<first, last, 1>(f);
+        });
+    }
+}
+
+constexpr size_t digit_block = 32;
+
 template <ct_str X, ct_str Y>
 constexpr bool will_overflow() {
     constexpr auto x = std::to_array(X.data);
@@ -92,7 +122,7 @@ constexpr bool will_overflow() {
 
     bool overflow = false;
 
-    constexpr_for<0, M - 1, 1>([&x, &y, &overflow](auto i) {
+    constexpr_for_blocked<0, M - 1, digit_block>([&x, &y, &overflow](auto i) {
         constexpr char cx = (i < SX - 1)  ? x[i] : '0';
         constexpr char cy = (i < SY - 1)  ? y[i] : '0';
 
@@ -112,6 +142,12 @@ constexpr bool will_overflow() {
     return overflow;
 }
 
+// Exact size of the buffer add<X, Y>() fills, known before any digit is written.
+template <ct_str X, ct_str Y>
+constexpr size_t sum_size() {
+    return std::max(X.size(), Y.size()) + int(will_overflow<X, Y>());
+}
+
 template <ct_str X, ct_str Y>
 constexpr auto add() {
     constexpr auto x = std::to_array(X.data);
@@ -119,7 +155,7 @@ constexpr auto add() {
     constexpr auto SX = std::size(x);
     constexpr auto SY = std::size(y);
     constexpr auto O = int(will_overflow<X, Y>());
-    constexpr auto Z = std::max(SX, SY) + O;
+    constexpr auto Z = sum_size<X, Y>();
 
     // static_assert(SX == 2);
     // static_assert(SY == 2);
@@ -130,7 +166,7 @@ constexpr auto add() {
     bool overflow = false;
     ct_str<Z> ret;
 
-    constexpr_for<0, Z - O - 1, 1>([&x, &y, &ret, &overflow](auto i){
+    constexpr_for_blocked<0, Z - O - 1, digit_block>([&x, &y, &ret, &overflow](auto i){
 
         constexpr char cx = (i < SX - 1)  ? x[i] : '0';
         constexpr char cy = (i < SY - 1)  ? y[i] : '0';
@@ -153,6 +189,357 @@ constexpr auto add() {
     return ret;
 }
 
+// A template parameter object exists once per distinct value across the whole
+// program, so its address is a stable handle: equal results, however they were
+// computed, get the same one. Handles compare the digit text, not the number:
+// intern<"01">() and intern<"1">() differ (and have different types).
+template <ct_str S>
+constexpr auto const* intern() {
+    return &S;
+}
+
+// Most significant digit first, read in place: nothing is reversed or copied,
+// and a consumer that stops after the leading digits touches nothing else.
+template <ct_str S>
+constexpr auto digits() {
+    struct view {
+        constexpr auto begin() const {
+            return std::make_reverse_iterator(std::end(S.data) - 1);
+        }
+
+        constexpr auto end() const {
+            return std::make_reverse_iterator(std::begin(S.data));
+        }
+    };
+    return view{};
+}
+
+// Opt-in counters for the kernels below when they run at runtime: call counts
+// and a histogram of the larger operand's bit width. Without GODEL_STATS the
+// hooks expand to nothing; constant evaluation is never recorded.
+#ifdef GODEL_STATS
+struct kernel_stats {
+    static constexpr size_t width_buckets = std::numeric_limits<size_t>::digits + 1;
+
+    std::atomic<size_t> calls{0};
+    std::array<std::atomic<size_t>, width_buckets> operand_bits{};
+};
+
+inline kernel_stats add_stats;
+inline kernel_stats mul_stats;
+inline kernel_stats div_stats;
+
+inline void record(kernel_stats& k, size_t x, size_t y) {
+    k.calls.fetch_add(1, std::memory_order_relaxed);
+    k.operand_bits[std::bit_width(std::max(x, y))].fetch_add(1, std::memory_order_relaxed);
+}
+
+#define GODEL_RECORD(k, x, y) do { if ( ! std::is_constant_evaluated()) record(k, x, y); } while (0)
+#else
+#define GODEL_RECORD(k, x, y) do {} while (0)
+#endif
+
+// Overflow throws, which turns a constant evaluation into a compile error.
+constexpr size_t checked_add(size_t x, size_t y) {
+    GODEL_RECORD(add_stats, x, y);
+    if (x > std::numeric_limits<size_t>::max() - y) {
+        throw std::overflow_error("godel number does not fit in size_t");
+    }
+    return x + y;
+}
+
+constexpr size_t checked_mul(size_t x, size_t y) {
+    GODEL_RECORD(mul_stats, x, y);
+    if (y != 0 && x > std::numeric_limits<size_t>::max() / y) {
+        throw std::overflow_error("godel number does not fit in size_t");
+    }
+    return x * y;
+}
+
+// Quotient and remainder from one division.
+constexpr std::pair<size_t, size_t> divide(size_t x, size_t y) {
+    GODEL_RECORD(div_stats, x, y);
+    return {x / y, x % y};
+}
+
+constexpr bool is_prime(size_t p) {
+    if (p < 2) {
+        return false;
+    }
+    for (size_t d = 2; d * d <= p; ++d) {
+        if (p % d == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr size_t next_prime(size_t p) {
+    while ( ! is_prime(++p)) {}
+    return p;
+}
+
+// Prime for position i given the prime p used for position i - 1 (any value
+// for i == 0): read from the generated table (primes.hpp) while in range, else
+// the next prime after p, so walking positions in order never searches twice.
+constexpr size_t prime_after(size_t i, size_t p) {
+    return i < std::size(primes) ? primes[i] : next_prime(p);
+}
+
+constexpr size_t checked_pow(size_t base, size_t exp) {
+    size_t r = 1;
+    while (exp != 0) {
+        if (exp % 2 != 0) {
+            r = checked_mul(r, base);
+        }
+        exp /= 2;
+        if (exp != 0) {
+            base = checked_mul(base, base);
+        }
+    }
+    return r;
+}
+
+// p^e for the prime p at position i, looked up in the generated power table
+// when p is in it; e past the table's run for p does not fit in size_t.
+constexpr size_t prime_power(size_t i, size_t p, size_t e) {
+    if (e == 0) {
+        return 1;
+    }
+    if (i + 1 < std::size(prime_power_offsets)) {
+        if (e > prime_power_offsets[i + 1] - prime_power_offsets[i]) {
+            throw std::overflow_error("godel number does not fit in size_t");
+        }
+        return prime_powers[prime_power_offsets[i] + e - 1];
+    }
+    return checked_pow(p, e);
+}
+
+// Classic numbering: s_0 s_1 ... -> 2^s_0 * 3^s_1 * ...
+struct prime_power_numbering {
+    template <size_t N>
+    static constexpr size_t encode(std::array<size_t, N> const& s) {
+        size_t n = 1;
+        size_t p = 1;
+        for (size_t i = 0; i < N; ++i) {
+            p = prime_after(i, p);
+            if (s[i] != 0) {
+                n = checked_mul(n, prime_power(i, p, s[i]));
+            }
+        }
+        return n;
+    }
+
+    // Exponent of position 0, 1, ... of n, produced one prime at a time: the
+    // exponent of p_i is available as soon as p_i is divided out, and nothing
+    // past the position a consumer stops at is computed. Ends once every
+    // factor of n is accounted for.
+    class exponent_iterator {
+        size_t before_ = 1; // n with positions < i divided out
+        size_t after_ = 1;  // n with positions <= i divided out
+        size_t i_ = 0;
+        size_t p_ = 2;
+        size_t e_ = 0;
+
+        constexpr void extract() {
+            e_ = 0;
+            after_ = before_;
+            while (after_ != 1) {
+                auto const [q, r] = divide(after_, p_);
+                if (r != 0) {
+                    break;
+                }
+                after_ = q;
+                ++e_;
+            }
+        }
+
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = size_t;
+
+        constexpr exponent_iterator() = default;
+
+        constexpr explicit exponent_iterator(size_t n)
+            : before_(n), p_(primes[0])
+        {
+            if (n == 0) {
+                throw std::domain_error("0 is not a prime-power godel number");
+            }
+            extract();
+        }
+
+        constexpr size_t operator*() const {
+            return e_;
+        }
+
+        constexpr exponent_iterator& operator++() {
+            before_ = after_;
+            ++i_;
+            if (before_ != 1) {
+                p_ = prime_after(i_, p_);
+            }
+            extract();
+            return *this;
+        }
+
+        constexpr exponent_iterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend constexpr bool operator==(exponent_iterator const& x, std::default_sentinel_t) {
+            return x.before_ == 1;
+        }
+    };
+
+    static constexpr auto exponents(size_t n) {
+        struct view {
+            size_t n;
+
+            constexpr auto begin() const {
+                return exponent_iterator(n);
+            }
+
+            constexpr auto end() const {
+                return std::default_sentinel;
+            }
+        };
+        return view{n};
+    }
+
+    template <size_t N>
+    static constexpr std::array<size_t, N> decode(size_t n) {
+        std::array<size_t, N> s{};
+        size_t i = 0;
+        for (size_t e : exponents(n)) {
+            if (i == N) {
+                throw std::domain_error("not a prime-power godel number of this length");
+            }
+            s[i++] = e;
+        }
+        return s;
+    }
+};
+
+// Iterated Cantor pairing: <s_0, <s_1, ... <s_N-2, s_N-1>>>, a bijection N^N -> N.
+struct cantor_numbering {
+    // w (w + 1) / 2 without overflowing the intermediate product.
+    static constexpr size_t triangular(size_t w) {
+        return w % 2 == 0 ? checked_mul(w / 2, w + 1) : checked_mul(w, (w + 1) / 2);
+    }
+
+    static constexpr size_t pair(size_t x, size_t y) {
+        return checked_add(triangular(checked_add(x, y)), y);
+    }
+
+    static constexpr std::pair<size_t, size_t> unpair(size_t z) {
+        // Largest w with triangular(w) <= z; 6074000999 is the largest w whose
+        // triangular number still fits in 64 bits.
+        static_assert(std::numeric_limits<size_t>::digits == 64);
+        size_t lo = 0;
+        size_t hi = std::min(z, size_t(6074000999));
+        while (lo < hi) {
+            size_t const mid = lo + (hi - lo + 1) / 2;
+            if (triangular(mid) <= z) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        size_t const y = z - triangular(lo);
+        return {lo - y, y};
+    }
+
+    template <size_t N>
+    static constexpr size_t encode(std::array<size_t, N> const& s) {
+        if constexpr (N == 0) {
+            return 0;
+        } else {
+            size_t n = s[N - 1];
+            for (size_t i = N - 1; i-- > 0; ) {
+                n = pair(s[i], n);
+            }
+            return n;
+        }
+    }
+
+    template <size_t N>
+    static constexpr std::array<size_t, N> decode(size_t n) {
+        std::array<size_t, N> s{};
+        if constexpr (N == 0) {
+            if (n != 0) {
+                throw std::domain_error("only 0 encodes the empty sequence");
+            }
+        } else {
+            for (size_t i = 0; i + 1 < N; ++i) {
+                auto const [x, y] = unpair(n);
+                s[i] = x;
+                n = y;
+            }
+            s[N - 1] = n;
+        }
+        return s;
+    }
+};
+
+// Bijective base-K: symbols in 1..K, s_0 least significant, trailing 0s mark
+// a shorter sequence (a 0 followed by a symbol is rejected). Every finite
+// sequence over 1..K gets a distinct n.
+template <size_t K>
+requires (K >= 1)
+struct bijective_base_numbering {
+    template <size_t N>
+    static constexpr size_t encode(std::array<size_t, N> const& s) {
+        size_t n = 0;
+        for (size_t i = N; i-- > 0; ) {
+            if (s[i] > K) {
+                throw std::out_of_range("symbol does not fit in bijective base");
+            }
+            if (s[i] == 0 && n != 0) {
+                throw std::out_of_range("symbol follows the end of the sequence");
+            }
+            n = checked_add(checked_mul(n, K), s[i]);
+        }
+        return n;
+    }
+
+    template <size_t N>
+    static constexpr std::array<size_t, N> decode(size_t n) {
+        std::array<size_t, N> s{};
+        for (size_t i = 0; i < N && n != 0; ++i) {
+            auto const [q, r] = divide(n, K);
+            s[i] = r == 0 ? K : r;
+            n = r == 0 ? q - 1 : q;
+        }
+        if (n != 0) {
+            throw std::domain_error("not a bijective base godel number of this length");
+        }
+        return s;
+    }
+};
+
+template <class Numbering, size_t N>
+constexpr size_t encode(std::array<size_t, N> const& s) {
+    return Numbering::encode(s);
+}
+
+template <class Numbering, size_t N>
+constexpr std::array<size_t, N> decode(size_t n) {
+    return Numbering::template decode<N>(n);
+}
+
+template <class Numbering, auto Seq>
+concept encodable = requires {
+    typename std::integral_constant<size_t, encode<Numbering>(Seq)>;
+};
+
+template <class Numbering, size_t N, size_t Number>
+concept decodable = requires {
+    typename std::integral_constant<size_t, decode<Numbering, N>(Number).size()>;
+};
+
 void will_overflow_static_tests() {
     static_assert( ! will_overflow<"0", "0">());
     static_assert( ! will_overflow<"0", "1">());
@@ -398,6 +785,11 @@ void will_overflow_static_tests() {
     static_assert( ! will_overflow<"69", "30">());
     static_assert( ! will_overflow<"79", "20">());
     static_assert( ! will_overflow<"89", "10">());
+
+    static_assert(   will_overflow<"9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999", "1">());
+    static_assert( ! will_overflow<"4444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444", "5555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555">());
+
+    static_assert( ! will_overflow<"444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444", "555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555">());
 }
 
 void add_digit_static_tests() {
@@ -513,6 +905,21 @@ void add_digit_static_tests() {
     static_assert(add_digit<'9', '9'>() == std::pair{true, '8'});
 }
 
+void sum_size_static_tests() {
+    static_assert(sum_size<"0", "0">() == 2);
+    static_assert(sum_size<"1", "8">() == 2);
+    static_assert(sum_size<"1", "9">() == 3);
+    static_assert(sum_size<"10", "9">() == 3);
+    static_assert(sum_size<"99", "1">() == 4);
+    static_assert(sum_size<"1", "99">() == 4);
+    static_assert(sum_size<"89", "10">() == 3);
+    static_assert(sum_size<"89", "11">() == 4);
+    static_assert(sum_size<"999999999", "1">() == 11);
+
+    static_assert(sum_size<"99", "1">() == add<"99", "1">().size());
+    static_assert(sum_size<"89", "10">() == add<"89", "10">().size());
+}
+
 void add_static_tests() {
     static_assert(add<"0", "0">() == ct_str("0"));
     static_assert(add<"0", "1">() == ct_str("1"));
@@ -767,11 +1174,187 @@ void add_static_tests() {
     static_assert(add<"9999999", "1">() == ct_str("10000000"));
     static_assert(add<"99999999", "1">() == ct_str("100000000"));
     static_assert(add<"999999999", "1">() == ct_str("1000000000"));
+
+    static_assert(add<"9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999", "1">() == ct_str("10000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"));
+    static_assert(add<"4444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444", "5555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555555">() == ct_str("9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999"));
+
+    // Longer than the 512-step constexpr depth a digit-at-a-time loop hits.
+    static_assert(add<"999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999", "1">() == ct_str("1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"));
 }
 
+void intern_static_tests() {
+    static_assert(intern<"0">() == intern<"0">());
+    static_assert(intern<"123">() == intern<"123">());
+    static_assert(intern<"123">() != intern<"124">());
+    static_assert(*intern<"123">() == ct_str("123"));
+
+    static_assert(intern<add<"1", "2">()>() == intern<"3">());
+    static_assert(intern<add<"99", "1">()>() == intern<"100">());
+    static_assert(intern<add<"29", "71">()>() == intern<add<"89", "11">()>());
+    static_assert(intern<add<"29", "70">()>() == intern<add<"89", "10">()>());
+    static_assert(intern<add<"29", "70">()>() != intern<add<"89", "9">()>());
+}
+
+void digits_static_tests() {
+    static_assert(*digits<"0">().begin() == '0');
+    static_assert(*digits<"123">().begin() == '1');
+    static_assert(*std::next(digits<"123">().begin()) == '2');
+    static_assert(std::distance(digits<"123">().begin(), digits<"123">().end()) == 3);
+    static_assert(std::equal(digits<"123">().begin(), digits<"123">().end(), "123"));
+
+    static_assert(*digits<add<"99", "1">()>().begin() == '1');
+    static_assert(std::equal(digits<add<"99", "1">()>().begin(), digits<add<"99", "1">()>().end(), "100"));
+    static_assert(std::equal(digits<add<"29", "70">()>().begin(), digits<add<"29", "70">()>().end(), "99"));
+}
+
+void numbering_static_tests() {
+    using seq2 = std::array<size_t, 2>;
+    using seq3 = std::array<size_t, 3>;
+
+    static_assert(primes[0] == 2);
+    static_assert(primes[1] == 3);
+    static_assert(primes[2] == 5);
+    static_assert(primes[9] == 29);
+    static_assert(primes[63] == 311);
+    static_assert(prime_after(0, 0) == 2);
+    static_assert(prime_after(9, 23) == 29);
+    static_assert(prime_after(65, 313) == 317);
+    static_assert(next_prime(311) == 313);
+    static_assert(prime_after(63, 307) == 311);
+    static_assert(prime_after(64, 311) == 313);
+
+    static_assert(checked_pow(2, 0) == 1);
+    static_assert(checked_pow(2, 10) == 1024);
+    static_assert(checked_pow(3, 40) == 12157665459056928801u);
+
+    static_assert(prime_power(0, 2, 0) == 1);
+    static_assert(prime_power(0, 2, 1) == 2);
+    static_assert(prime_power(0, 2, 63) == size_t(1) << 63);
+    static_assert(prime_power(1, 3, 40) == checked_pow(3, 40));
+    static_assert(prime_power(63, 311, 7) == checked_pow(311, 7));
+    static_assert(prime_power(64, 313, 2) == 313 * 313);
+    static_assert(encode<prime_power_numbering>(seq3{0, 40, 0}) == checked_pow(3, 40));
+    static_assert( ! encodable<prime_power_numbering, seq3{64, 0, 0}>);
+    static_assert( ! encodable<prime_power_numbering, seq3{0, 41, 0}>);
+
+    static_assert(encode<prime_power_numbering>(seq3{0, 0, 0}) == 1);
+    static_assert(encode<prime_power_numbering>(seq3{1, 2, 0}) == 18);
+    static_assert(encode<prime_power_numbering>(seq3{0, 0, 1}) == 5);
+    static_assert(encode<prime_power_numbering>(seq3{63, 0, 0}) == size_t(1) << 63);
+    static_assert(decode<prime_power_numbering, 3>(18) == seq3{1, 2, 0});
+    static_assert(decode<prime_power_numbering, 3>(5) == seq3{0, 0, 1});
+    constexpr auto last_of_101 = [] {
+        std::array<size_t, 101> s{};
+        s[100] = 1;
+        return s;
+    }();
+    static_assert(encode<prime_power_numbering>(last_of_101) == 547);
+    static_assert(decode<prime_power_numbering, 101>(547) == last_of_101);
+
+    static_assert(std::input_iterator<prime_power_numbering::exponent_iterator>);
+    static_assert(*prime_power_numbering::exponents(18).begin() == 1);
+    static_assert(*std::ranges::next(prime_power_numbering::exponents(18).begin()) == 2);
+    static_assert(std::ranges::distance(prime_power_numbering::exponents(18)) == 2);
+    static_assert(std::ranges::distance(prime_power_numbering::exponents(5)) == 3);
+    static_assert(std::ranges::distance(prime_power_numbering::exponents(1)) == 0);
+    static_assert(*prime_power_numbering::exponents(size_t(1) << 63).begin() == 63);
+    static_assert(decodable<prime_power_numbering, 3, 18>);
+    static_assert( ! decodable<prime_power_numbering, 2, 5>);
+    static_assert( ! decodable<prime_power_numbering, 2, 7>);
+    static_assert( ! decodable<prime_power_numbering, 3, 0>);
+
+    static_assert(encode<cantor_numbering>(seq2{0, 0}) == 0);
+    static_assert(encode<cantor_numbering>(seq2{1, 0}) == 1);
+    static_assert(encode<cantor_numbering>(seq2{0, 1}) == 2);
+    static_assert(encode<cantor_numbering>(seq2{2, 3}) == 18);
+    static_assert(encode<cantor_numbering>(seq3{1, 2, 3}) == 208);
+    static_assert(decode<cantor_numbering, 2>(18) == seq2{2, 3});
+    static_assert(decode<cantor_numbering, 3>(208) == seq3{1, 2, 3});
+    static_assert(decode<cantor_numbering, 0>(0) == std::array<size_t, 0>{});
+    static_assert(decodable<cantor_numbering, 0, 0>);
+    static_assert( ! decodable<cantor_numbering, 0, 1>);
+    static_assert(decode<cantor_numbering, 3>(encode<cantor_numbering>(seq3{9, 0, 7})) == seq3{9, 0, 7});
+    static_assert(encode<cantor_numbering>(decode<cantor_numbering, 2>(std::numeric_limits<size_t>::max())) == std::numeric_limits<size_t>::max());
+
+    static_assert(encode<bijective_base_numbering<3>>(seq3{0, 0, 0}) == 0);
+    static_assert(encode<bijective_base_numbering<3>>(seq3{3, 0, 0}) == 3);
+    static_assert(encode<bijective_base_numbering<3>>(seq3{1, 1, 0}) == 4);
+    static_assert(encode<bijective_base_numbering<3>>(seq3{1, 2, 3}) == 34);
+    static_assert(decode<bijective_base_numbering<3>, 3>(34) == seq3{1, 2, 3});
+    static_assert(decode<bijective_base_numbering<3>, 3>(3) == seq3{3, 0, 0});
+    static_assert(decode<bijective_base_numbering<3>, 3>(0) == seq3{0, 0, 0});
+    static_assert(decode<bijective_base_numbering<3>, 3>(encode<bijective_base_numbering<3>>(seq3{2, 1, 0})) == seq3{2, 1, 0});
+    static_assert(decode<bijective_base_numbering<3>, 3>(encode<bijective_base_numbering<3>>(seq3{2, 0, 0})) == seq3{2, 0, 0});
+    static_assert(encodable<bijective_base_numbering<3>, seq3{1, 3, 0}>);
+    static_assert( ! encodable<bijective_base_numbering<3>, seq3{1, 0, 1}>);
+    static_assert( ! encodable<bijective_base_numbering<3>, seq3{0, 0, 1}>);
+    static_assert( ! encodable<bijective_base_numbering<3>, seq3{4, 0, 0}>);
+    static_assert(decodable<bijective_base_numbering<3>, 3, 39>);
+    static_assert( ! decodable<bijective_base_numbering<3>, 3, 40>);
+
+    static_assert(encode<bijective_base_numbering<10>>(seq3{9, 9, 9}) == 999);
+    static_assert(encode<cantor_numbering>(seq3{9, 9, 9}) < encode<prime_power_numbering>(seq3{9, 9, 9}));
+    static_assert(encode<bijective_base_numbering<10>>(seq3{9, 9, 9}) < encode<cantor_numbering>(seq3{9, 9, 9}));
+}
+
+#ifdef GODEL_STATS
+// Not assert(): these checks must also run in NDEBUG builds, which is where
+// the counters are meant to be used.
+#define GODEL_CHECK(cond) do { \
+    if ( ! (cond)) { \
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        std::abort(); \
+    } \
+} while (0)
+
+void stats_tests() {
+    auto const snapshot = [](kernel_stats const& k) {
+        std::array<size_t, kernel_stats::width_buckets + 1> r{k.calls.load()};
+        for (size_t b = 0; b < kernel_stats::width_buckets; ++b) {
+            r[b + 1] = k.operand_bits[b].load();
+        }
+        return r;
+    };
+
+    auto const recorded = [&](kernel_stats const& k, auto const& before) {
+        auto const after = snapshot(k);
+        size_t histogram = 0;
+        for (size_t b = 1; b < std::size(after); ++b) {
+            histogram += after[b] - before[b];
+        }
+        GODEL_CHECK(histogram == after[0] - before[0]);
+        return after[0] - before[0];
+    };
+
+    auto const mul_before = snapshot(mul_stats);
+    auto const div_before = snapshot(div_stats);
+
+    // Not const: a const integral initializer would be constant-evaluated.
+    size_t n = encode<prime_power_numbering>(std::array<size_t, 3>{1, 5, 2});
+    GODEL_CHECK(n == 12150);
+    GODEL_CHECK(recorded(mul_stats, mul_before) > 0);
+
+    auto const s = decode<prime_power_numbering, 3>(n);
+    GODEL_CHECK((s == std::array<size_t, 3>{1, 5, 2}));
+    // 1 + 5 + 2 exact divisions, plus the trial that ends positions 0 and 1;
+    // position 2 stops as soon as nothing is left to divide.
+    GODEL_CHECK(recorded(div_stats, div_before) == 8 + 2);
+    GODEL_CHECK(div_stats.operand_bits[std::bit_width(n)] == div_before[std::bit_width(n) + 1] + 1);
+
+    // The hook is a single statement, so an else binds to the caller's if.
+    bool taken = false;
+    if (n == 0) GODEL_RECORD(add_stats, n, n); else taken = true;
+    GODEL_CHECK(taken);
+}
+#endif
+
 #include <iostream>
 
 int main() {
+#ifdef GODEL_STATS
+    stats_tests();
+#endif
+
     // static_assert("123"_n == chr_arr<4>{'1','2','3','\0'});
 
     // static_assert(std::to_array(add<"1", "2">().data) == chr_arr<2>{'3', '\0'});
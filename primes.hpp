@@ -0,0 +1,205 @@
+// Generated by gen_primes.cpp; do not edit.
+#pragma once
+
+#include <cstddef>
+
+#include <array>
+#include <limits>
+
+static_assert(std::numeric_limits<size_t>::digits == 64);
+
+inline constexpr std::array<size_t, 64> primes = {
+    2u, 3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u, 29u, 31u, 37u, 41u, 43u, 47u, 53u,
+    59u, 61u, 67u, 71u, 73u, 79u, 83u, 89u, 97u, 101u, 103u, 107u, 109u, 113u, 127u, 131u,
+    137u, 139u, 149u, 151u, 157u, 163u, 167u, 173u, 179u, 181u, 191u, 193u, 197u, 199u, 211u, 223u,
+    227u, 229u, 233u, 239u, 241u, 251u, 257u, 263u, 269u, 271u, 277u, 281u, 283u, 293u, 307u, 311u,
+};
+
+inline constexpr std::array<size_t, 65> prime_power_offsets = {
+    0u, 63u, 103u, 130u, 152u, 170u, 187u, 202u, 217u, 231u, 244u, 256u, 268u, 279u, 290u, 301u,
+    312u, 322u, 332u, 342u, 352u, 362u, 372u, 382u, 391u, 400u, 409u, 418u, 427u, 436u, 445u, 454u,
+    463u, 472u, 480u, 488u, 496u, 504u, 512u, 520u, 528u, 536u, 544u, 552u, 560u, 568u, 576u, 584u,
+    592u, 600u, 608u, 616u, 624u, 632u, 640u, 647u, 654u, 661u, 668u, 675u, 682u, 689u, 696u, 703u,
+    710u,
+};
+
+inline constexpr std::array<size_t, 710> prime_powers = {
+    2u, 4u, 8u, 16u,
+    32u, 64u, 128u, 256u,
+    512u, 1024u, 2048u, 4096u,
+    8192u, 16384u, 32768u, 65536u,
+    131072u, 262144u, 524288u, 1048576u,
+    2097152u, 4194304u, 8388608u, 16777216u,
+    33554432u, 67108864u, 134217728u, 268435456u,
+    536870912u, 1073741824u, 2147483648u, 4294967296u,
+    8589934592u, 17179869184u, 34359738368u, 68719476736u,
+    137438953472u, 274877906944u, 549755813888u, 1099511627776u,
+    2199023255552u, 4398046511104u, 8796093022208u, 17592186044416u,
+    35184372088832u, 70368744177664u, 140737488355328u, 281474976710656u,
+    562949953421312u, 1125899906842624u, 2251799813685248u, 4503599627370496u,
+    9007199254740992u, 18014398509481984u, 36028797018963968u, 72057594037927936u,
+    144115188075855872u, 288230376151711744u, 576460752303423488u, 1152921504606846976u,
+    2305843009213693952u, 4611686018427387904u, 9223372036854775808u, 3u,
+    9u, 27u, 81u, 243u,
+    729u, 2187u, 6561u, 19683u,
+    59049u, 177147u, 531441u, 1594323u,
+    4782969u, 14348907u, 43046721u, 129140163u,
+    387420489u, 1162261467u, 3486784401u, 10460353203u,
+    31381059609u, 94143178827u, 282429536481u, 847288609443u,
+    2541865828329u, 7625597484987u, 22876792454961u, 68630377364883u,
+    205891132094649u, 617673396283947u, 1853020188851841u, 5559060566555523u,
+    16677181699666569u, 50031545098999707u, 150094635296999121u, 450283905890997363u,
+    1350851717672992089u, 4052555153018976267u, 12157665459056928801u, 5u,
+    25u, 125u, 625u, 3125u,
+    15625u, 78125u, 390625u, 1953125u,
+    9765625u, 48828125u, 244140625u, 1220703125u,
+    6103515625u, 30517578125u, 152587890625u, 762939453125u,
+    3814697265625u, 19073486328125u, 95367431640625u, 476837158203125u,
+    2384185791015625u, 11920928955078125u, 59604644775390625u, 298023223876953125u,
+    1490116119384765625u, 7450580596923828125u, 7u, 49u,
+    343u, 2401u, 16807u, 117649u,
+    823543u, 5764801u, 40353607u, 282475249u,
+    1977326743u, 13841287201u, 96889010407u, 678223072849u,
+    4747561509943u, 33232930569601u, 232630513987207u, 1628413597910449u,
+    11398895185373143u, 79792266297612001u, 558545864083284007u, 3909821048582988049u,
+    11u, 121u, 1331u, 14641u,
+    161051u, 1771561u, 19487171u, 214358881u,
+    2357947691u, 25937424601u, 285311670611u, 3138428376721u,
+    34522712143931u, 379749833583241u, 4177248169415651u, 45949729863572161u,
+    505447028499293771u, 5559917313492231481u, 13u, 169u,
+    2197u, 28561u, 371293u, 4826809u,
+    62748517u, 815730721u, 10604499373u, 137858491849u,
+    1792160394037u, 23298085122481u, 302875106592253u, 3937376385699289u,
+    51185893014090757u, 665416609183179841u, 8650415919381337933u, 17u,
+    289u, 4913u, 83521u, 1419857u,
+    24137569u, 410338673u, 6975757441u, 118587876497u,
+    2015993900449u, 34271896307633u, 582622237229761u, 9904578032905937u,
+    168377826559400929u, 2862423051509815793u, 19u, 361u,
+    6859u, 130321u, 2476099u, 47045881u,
+    893871739u, 16983563041u, 322687697779u, 6131066257801u,
+    116490258898219u, 2213314919066161u, 42052983462257059u, 799006685782884121u,
+    15181127029874798299u, 23u, 529u, 12167u,
+    279841u, 6436343u, 148035889u, 3404825447u,
+    78310985281u, 1801152661463u, 41426511213649u, 952809757913927u,
+    21914624432020321u, 504036361936467383u, 11592836324538749809u, 29u,
+    841u, 24389u, 707281u, 20511149u,
+    594823321u, 17249876309u, 500246412961u, 14507145975869u,
+    420707233300201u, 12200509765705829u, 353814783205469041u, 10260628712958602189u,
+    31u, 961u, 29791u, 923521u,
+    28629151u, 887503681u, 27512614111u, 852891037441u,
+    26439622160671u, 819628286980801u, 25408476896404831u, 787662783788549761u,
+    37u, 1369u, 50653u, 1874161u,
+    69343957u, 2565726409u, 94931877133u, 3512479453921u,
+    129961739795077u, 4808584372417849u, 177917621779460413u, 6582952005840035281u,
+    41u, 1681u, 68921u, 2825761u,
+    115856201u, 4750104241u, 194754273881u, 7984925229121u,
+    327381934393961u, 13422659310152401u, 550329031716248441u, 43u,
+    1849u, 79507u, 3418801u, 147008443u,
+    6321363049u, 271818611107u, 11688200277601u, 502592611936843u,
+    21611482313284249u, 929293739471222707u, 47u, 2209u,
+    103823u, 4879681u, 229345007u, 10779215329u,
+    506623120463u, 23811286661761u, 1119130473102767u, 52599132235830049u,
+    2472159215084012303u, 53u, 2809u, 148877u,
+    7890481u, 418195493u, 22164361129u, 1174711139837u,
+    62259690411361u, 3299763591802133u, 174887470365513049u, 9269035929372191597u,
+    59u, 3481u, 205379u, 12117361u,
+    714924299u, 42180533641u, 2488651484819u, 146830437604321u,
+    8662995818654939u, 511116753300641401u, 61u, 3721u,
+    226981u, 13845841u, 844596301u, 51520374361u,
+    3142742836021u, 191707312997281u, 11694146092834141u, 713342911662882601u,
+    67u, 4489u, 300763u, 20151121u,
+    1350125107u, 90458382169u, 6060711605323u, 406067677556641u,
+    27206534396294947u, 1822837804551761449u, 71u, 5041u,
+    357911u, 25411681u, 1804229351u, 128100283921u,
+    9095120158391u, 645753531245761u, 45848500718449031u, 3255243551009881201u,
+    73u, 5329u, 389017u, 28398241u,
+    2073071593u, 151334226289u, 11047398519097u, 806460091894081u,
+    58871586708267913u, 4297625829703557649u, 79u, 6241u,
+    493039u, 38950081u, 3077056399u, 243087455521u,
+    19203908986159u, 1517108809906561u, 119851595982618319u, 9468276082626847201u,
+    83u, 6889u, 571787u, 47458321u,
+    3939040643u, 326940373369u, 27136050989627u, 2252292232139041u,
+    186940255267540403u, 15516041187205853449u, 89u, 7921u,
+    704969u, 62742241u, 5584059449u, 496981290961u,
+    44231334895529u, 3936588805702081u, 350356403707485209u, 97u,
+    9409u, 912673u, 88529281u, 8587340257u,
+    832972004929u, 80798284478113u, 7837433594376961u, 760231058654565217u,
+    101u, 10201u, 1030301u, 104060401u,
+    10510100501u, 1061520150601u, 107213535210701u, 10828567056280801u,
+    1093685272684360901u, 103u, 10609u, 1092727u,
+    112550881u, 11592740743u, 1194052296529u, 122987386542487u,
+    12667700813876161u, 1304773183829244583u, 107u, 11449u,
+    1225043u, 131079601u, 14025517307u, 1500730351849u,
+    160578147647843u, 17181861798319201u, 1838459212420154507u, 109u,
+    11881u, 1295029u, 141158161u, 15386239549u,
+    1677100110841u, 182803912081669u, 19925626416901921u, 2171893279442309389u,
+    113u, 12769u, 1442897u, 163047361u,
+    18424351793u, 2081951752609u, 235260548044817u, 26584441929064321u,
+    3004041937984268273u, 127u, 16129u, 2048383u,
+    260144641u, 33038369407u, 4195872914689u, 532875860165503u,
+    67675234241018881u, 8594754748609397887u, 131u, 17161u,
+    2248091u, 294499921u, 38579489651u, 5053913144281u,
+    662062621900811u, 86730203469006241u, 11361656654439817571u, 137u,
+    18769u, 2571353u, 352275361u, 48261724457u,
+    6611856250609u, 905824306333433u, 124097929967680321u, 17001416405572203977u,
+    139u, 19321u, 2685619u, 373301041u,
+    51888844699u, 7212549413161u, 1002544368429379u, 139353667211683681u,
+    149u, 22201u, 3307949u, 492884401u,
+    73439775749u, 10942526586601u, 1630436461403549u, 242935032749128801u,
+    151u, 22801u, 3442951u, 519885601u,
+    78502725751u, 11853911588401u, 1789940649848551u, 270281038127131201u,
+    157u, 24649u, 3869893u, 607573201u,
+    95388992557u, 14976071831449u, 2351243277537493u, 369145194573386401u,
+    163u, 26569u, 4330747u, 705911761u,
+    115063617043u, 18755369578009u, 3057125241215467u, 498311414318121121u,
+    167u, 27889u, 4657463u, 777796321u,
+    129891985607u, 21691961596369u, 3622557586593623u, 604967116961135041u,
+    173u, 29929u, 5177717u, 895745041u,
+    154963892093u, 26808753332089u, 4637914326451397u, 802359178476091681u,
+    179u, 32041u, 5735339u, 1026625681u,
+    183765996899u, 32894113444921u, 5888046306640859u, 1053960288888713761u,
+    181u, 32761u, 5929741u, 1073283121u,
+    194264244901u, 35161828327081u, 6364290927201661u, 1151936657823500641u,
+    191u, 36481u, 6967871u, 1330863361u,
+    254194901951u, 48551226272641u, 9273284218074431u, 1771197285652216321u,
+    193u, 37249u, 7189057u, 1387488001u,
+    267785184193u, 51682540549249u, 9974730326005057u, 1925122952918976001u,
+    197u, 38809u, 7645373u, 1506138481u,
+    296709280757u, 58451728309129u, 11514990476898413u, 2268453123948987361u,
+    199u, 39601u, 7880599u, 1568239201u,
+    312079600999u, 62103840598801u, 12358664279161399u, 2459374191553118401u,
+    211u, 44521u, 9393931u, 1982119441u,
+    418227202051u, 88245939632761u, 18619893262512571u, 3928797478390152481u,
+    223u, 49729u, 11089567u, 2472973441u,
+    551473077343u, 122978496247489u, 27424204663190047u, 6115597639891380481u,
+    227u, 51529u, 11697083u, 2655237841u,
+    602738989907u, 136821750708889u, 31058537410917803u, 7050287992278341281u,
+    229u, 52441u, 12008989u, 2750058481u,
+    629763392149u, 144215816802121u, 33025422047685709u, 7562821648920027361u,
+    233u, 54289u, 12649337u, 2947295521u,
+    686719856393u, 160005726539569u, 37281334283719577u, 8686550888106661441u,
+    239u, 57121u, 13651919u, 3262808641u,
+    779811265199u, 186374892382561u, 44543599279432079u, 10645920227784266881u,
+    241u, 58081u, 13997521u, 3373402561u,
+    812990017201u, 195930594145441u, 47219273189051281u, 11379844838561358721u,
+    251u, 63001u, 15813251u, 3969126001u,
+    996250626251u, 250058907189001u, 62764785704439251u, 15753961211814252001u,
+    257u, 66049u, 16974593u, 4362470401u,
+    1121154893057u, 288136807515649u, 74051159531521793u, 263u,
+    69169u, 18191447u, 4784350561u, 1258284197543u,
+    330928743953809u, 87034259659851767u, 269u, 72361u,
+    19465109u, 5236114321u, 1408514752349u, 378890468381881u,
+    101921535994725989u, 271u, 73441u, 19902511u,
+    5393580481u, 1461660310351u, 396109944105121u, 107345794852487791u,
+    277u, 76729u, 21253933u, 5887339441u,
+    1630793025157u, 451729667968489u, 125129118027271453u, 281u,
+    78961u, 22188041u, 6234839521u, 1751989905401u,
+    492309163417681u, 138338874920368361u, 283u, 80089u,
+    22665187u, 6414247921u, 1815232161643u, 513710701744969u,
+    145380128593826227u, 293u, 85849u, 25153757u,
+    7370050801u, 2159424884693u, 632711491215049u, 185384466926009357u,
+    307u, 94249u, 28934443u, 8882874001u,
+    2727042318307u, 837201991720249u, 257021011458116443u, 311u,
+    96721u, 30080231u, 9354951841u, 2909390022551u,
+    904820297013361u, 281399112371155271u,
+};